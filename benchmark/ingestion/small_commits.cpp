@@ -0,0 +1,57 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+#include "duckdb/common/thread.hpp"
+
+using namespace duckdb;
+
+//////////////////////////
+// CONCURRENT COMMITS //
+//////////////////////////
+// Many connections that each commit a few rows at a time: the throughput is bound by how the WAL is synced
+#define SMALL_COMMITS_CONNECTIONS 8
+#define SMALL_COMMITS_PER_CONNECTION 250
+
+#define SMALL_COMMITS_BENCHMARK(SYNC_MODE)                                                                             \
+	bool InMemory() override {                                                                                         \
+		return false;                                                                                                  \
+	}                                                                                                                  \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query("SET wal_sync_mode='" SYNC_MODE "'");                                                        \
+		state->conn.Query("CREATE TABLE ingest(id INTEGER, payload VARCHAR)");                                         \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		vector<thread> threads;                                                                                        \
+		for (idx_t t = 0; t < SMALL_COMMITS_CONNECTIONS; t++) {                                                        \
+			threads.emplace_back([state, t]() {                                                                        \
+				Connection con(state->db);                                                                             \
+				auto prepared = con.Prepare("INSERT INTO ingest VALUES ($1, 'payload')");                              \
+				for (idx_t i = 0; i < SMALL_COMMITS_PER_CONNECTION; i++) {                                             \
+					prepared->Execute(Value::INTEGER(int32_t(t * SMALL_COMMITS_PER_CONNECTION + i)));                  \
+				}                                                                                                      \
+			});                                                                                                        \
+		}                                                                                                              \
+		for (auto &thread : threads) {                                                                                 \
+			thread.join();                                                                                             \
+		}                                                                                                              \
+	}                                                                                                                  \
+	void Cleanup(DuckDBBenchmarkState *state) override {                                                               \
+		state->conn.Query("DELETE FROM ingest");                                                                       \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return "Commit 2000 single-row INSERT statements from 8 concurrent connections with wal_sync_mode=" SYNC_MODE; \
+	}
+
+DUCKDB_BENCHMARK(SmallCommitsSyncPerCommit, "[ingestion]")
+SMALL_COMMITS_BENCHMARK("commit")
+FINISH_BENCHMARK(SmallCommitsSyncPerCommit)
+
+DUCKDB_BENCHMARK(SmallCommitsGroupCommit, "[ingestion]")
+SMALL_COMMITS_BENCHMARK("group")
+FINISH_BENCHMARK(SmallCommitsGroupCommit)
+
+DUCKDB_BENCHMARK(SmallCommitsOSSync, "[ingestion]")
+SMALL_COMMITS_BENCHMARK("os")
+FINISH_BENCHMARK(SmallCommitsOSSync)